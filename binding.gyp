@@ -5,7 +5,10 @@
       "src/addon.cpp",
       "src/connection_pool.cpp",
       "src/connection.cpp",
-      "src/listener.cpp"
+      "src/listener.cpp",
+      "src/pool_registry.cpp",
+      "src/query_control.cpp",
+      "src/tracked_threads.cpp"
     ],
     "include_dirs": [
       "<!@(node -p \"require('node-addon-api').include\")"
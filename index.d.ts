@@ -5,11 +5,33 @@ export interface PoolStatus {
     closed: boolean;
 }
 
+export interface QueryOptions {
+    /** Cancel the query on the server and reject if it runs longer than this (ms) */
+    timeoutMs?: number;
+    /** Cancel the query on the server and reject when this signal aborts */
+    signal?: AbortSignal;
+}
+
+export interface ConnectionOptions {
+    /** Attach to a process-wide pool shared by every connection (in any worker thread) using this key */
+    sharedPool?: string;
+}
+
+export interface ConnectOptions extends ConnectionOptions {
+    /** Pool size (default: 10) */
+    poolSize?: number;
+    /** Number of connections that must be open before the promise resolves (default: 1) */
+    minIdle?: number;
+}
+
 export class Connection {
-    constructor(connectionString: string, poolSize?: number);
+    constructor(connectionString: string, poolSize?: number, options?: ConnectionOptions);
+
+    /** Open the pool off the main thread, resolving once `minIdle` connections are ready */
+    static connect(connectionString: string, options?: ConnectOptions): Promise<Connection>;
 
     /** Execute a query asynchronously with optional parameters */
-    query<T = any>(sql: string, params?: any[]): Promise<T[]>;
+    query<T = any>(sql: string, params?: any[], options?: QueryOptions): Promise<T[]>;
 
     /** Execute a query synchronously with optional parameters */
     querySync<T = any>(sql: string, params?: any[]): T[];
@@ -18,10 +40,10 @@ export class Connection {
     prepare(name: string, sql: string): void;
 
     /** Execute a previously prepared statement */
-    execute<T = any>(name: string, params?: any[]): Promise<T[]>;
+    execute<T = any>(name: string, params?: any[], options?: QueryOptions): Promise<T[]>;
 
     /** Execute multiple queries in a pipeline, returns affected row counts */
-    pipeline(queries: string[]): Promise<number[]>;
+    pipeline(queries: string[], options?: QueryOptions): Promise<number[]>;
 
     /** Begin a transaction */
     begin(): Promise<void>;
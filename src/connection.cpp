@@ -1,6 +1,8 @@
 #include "connection.h"
+#include "pool_registry.h"
 #include <thread>
 #include <cmath>
+#include <algorithm>
 #include <optional>
 
 // --- Type conversion utilities ---
@@ -99,26 +101,179 @@ inline ConvertedParams ConvertParams(const Napi::CallbackInfo& info, size_t para
     return result;
 }
 
+// --- Query options (timeoutMs / signal) ---
+
+struct QueryOptions {
+    uint32_t timeoutMs = 0;
+    Napi::Object signal;
+};
+
+// setTimeout() clamps anything above 2^31-1 ms to 1 ms, so cap it ourselves
+static constexpr double MAX_TIMEOUT_MS = 2147483647.0;
+
+inline bool ParseQueryOptions(const Napi::CallbackInfo& info, size_t optIndex, QueryOptions& opts) {
+    if (info.Length() <= optIndex || info[optIndex].IsUndefined() || info[optIndex].IsNull()) return true;
+
+    auto env = info.Env();
+    if (!info[optIndex].IsObject()) {
+        Napi::TypeError::New(env, "Query options must be an object").ThrowAsJavaScriptException();
+        return false;
+    }
+    auto obj = info[optIndex].As<Napi::Object>();
+
+    auto timeout = obj.Get("timeoutMs");
+    if (!timeout.IsUndefined()) {
+        if (!timeout.IsNumber()) {
+            Napi::TypeError::New(env, "timeoutMs must be a number").ThrowAsJavaScriptException();
+            return false;
+        }
+        double ms = timeout.As<Napi::Number>().DoubleValue();
+        if (!(ms >= 0)) {
+            Napi::RangeError::New(env, "timeoutMs must not be negative").ThrowAsJavaScriptException();
+            return false;
+        }
+        opts.timeoutMs = static_cast<uint32_t>(std::ceil(std::min(ms, MAX_TIMEOUT_MS)));
+    }
+
+    auto signal = obj.Get("signal");
+    if (!signal.IsUndefined()) {
+        if (!signal.IsObject() || !signal.As<Napi::Object>().Get("addEventListener").IsFunction()) {
+            Napi::TypeError::New(env, "signal must be an AbortSignal").ThrowAsJavaScriptException();
+            return false;
+        }
+        opts.signal = signal.As<Napi::Object>();
+    }
+    return true;
+}
+
 // --- Async workers ---
 
-struct QueryWorker : Napi::AsyncWorker {
+// Base for workers that honour QueryOptions. The timer and the abort listener
+// both fire on the JS thread: they reject the promise immediately and hand the
+// server-side cancel off to QueryControl. The worker keeps its connection until
+// the cancel has been processed, then returns it to the pool as usual.
+struct CancellableWorker : Napi::AsyncWorker {
+    Napi::Promise::Deferred deferred;
+    std::shared_ptr<QueryControl> control;
+    Napi::ObjectReference timer;
+    Napi::ObjectReference signal;
+    Napi::FunctionReference onAbort;
+    bool settled = false;
+    bool reusable = true;
+
+    CancellableWorker(Napi::Env env, Napi::Promise::Deferred d)
+        : AsyncWorker(env), deferred(d) {}
+
+    void Arm(const QueryOptions& opts) {
+        if (opts.timeoutMs == 0 && opts.signal.IsEmpty()) return;
+
+        auto env = Env();
+        control = std::make_shared<QueryControl>();
+
+        if (!opts.signal.IsEmpty()) {
+            if (opts.signal.Get("aborted").ToBoolean()) {
+                Abort(opts.signal.Get("reason"));
+                return;
+            }
+            signal = Napi::Persistent(opts.signal);
+            onAbort = Napi::Persistent(Napi::Function::New(env, [this](const Napi::CallbackInfo&) {
+                Abort(signal.Value().Get("reason"));
+            }));
+            signal.Value().Get("addEventListener").As<Napi::Function>()
+                .Call(signal.Value(), {Napi::String::New(env, "abort"), onAbort.Value()});
+        }
+
+        if (opts.timeoutMs > 0) {
+            uint32_t ms = opts.timeoutMs;
+            auto onTimeout = Napi::Function::New(env, [this, ms](const Napi::CallbackInfo& info) {
+                auto error = Napi::Error::New(info.Env(), "Query timed out after " + std::to_string(ms) + "ms");
+                error.Value().Set("code", "ETIMEDOUT");
+                CancelWith(error.Value());
+            });
+            timer = Napi::Persistent(env.Global().Get("setTimeout").As<Napi::Function>()
+                .Call({onTimeout, Napi::Number::New(env, ms)}).As<Napi::Object>());
+        }
+    }
+
+    bool Cancelled() const {
+        return control && control->cancelled();
+    }
+
+    void ReturnConnection(const std::shared_ptr<ConnectionPool>& pool, const std::shared_ptr<pqxx::connection>& conn) {
+        if (!conn) return;
+        if (reusable) pool->release(conn);
+        else pool->discard(conn);
+    }
+
+    void Abort(Napi::Value reason) {
+        if (reason.IsUndefined()) {
+            auto error = Napi::Error::New(Env(), "Query aborted");
+            error.Value().Set("name", "AbortError");
+            reason = error.Value();
+        }
+        CancelWith(reason);
+    }
+
+    void CancelWith(Napi::Value reason) {
+        if (settled) return;
+        control->cancel();
+        Reject(reason);
+    }
+
+    void Resolve(Napi::Value value) {
+        if (settled) return;
+        settled = true;
+        Disarm();
+        deferred.Resolve(value);
+    }
+
+    void Reject(Napi::Value reason) {
+        if (settled) return;
+        settled = true;
+        Disarm();
+        deferred.Reject(reason);
+    }
+
+    void Disarm() {
+        auto env = Env();
+        if (!timer.IsEmpty()) {
+            env.Global().Get("clearTimeout").As<Napi::Function>().Call({timer.Value()});
+            timer.Reset();
+        }
+        if (!onAbort.IsEmpty()) {
+            signal.Value().Get("removeEventListener").As<Napi::Function>()
+                .Call(signal.Value(), {Napi::String::New(env, "abort"), onAbort.Value()});
+            onAbort.Reset();
+            signal.Reset();
+        }
+    }
+};
+
+struct QueryWorker : CancellableWorker {
     std::shared_ptr<ConnectionPool> pool;
     std::string sql;
     pqxx::params parms;
     bool hasParams;
     pqxx::result result;
-    Napi::Promise::Deferred deferred;
     std::shared_ptr<pqxx::connection> conn;
 
     QueryWorker(Napi::Env env, std::shared_ptr<ConnectionPool> p, std::string s, ConvertedParams cp, Napi::Promise::Deferred d)
-        : AsyncWorker(env), pool(p), sql(std::move(s)), parms(std::move(cp.parms)), hasParams(!cp.empty), deferred(d) {}
+        : CancellableWorker(env, d), pool(p), sql(std::move(s)), parms(std::move(cp.parms)), hasParams(!cp.empty) {}
 
     void Execute() override {
+        if (Cancelled()) {
+            SetError("Query cancelled");
+            return;
+        }
         conn = pool->acquire();
         if (!conn) {
             SetError("Failed to acquire connection from pool");
             return;
         }
+        if (control && !control->attach(conn)) {
+            SetError("Query cancelled");
+            return;
+        }
         try {
             pqxx::nontransaction txn(*conn);
             result = hasParams
@@ -127,61 +282,80 @@ struct QueryWorker : Napi::AsyncWorker {
         } catch (const std::exception& e) {
             SetError(e.what());
         }
+        if (control) reusable = control->detach();
     }
 
     void OnOK() override {
-        if (conn) pool->release(conn);
-        deferred.Resolve(ConvertResult(Env(), result));
+        ReturnConnection(pool, conn);
+        if (settled) return;
+        Resolve(ConvertResult(Env(), result));
     }
 
     void OnError(const Napi::Error& e) override {
-        if (conn) pool->release(conn);
-        deferred.Reject(e.Value());
+        ReturnConnection(pool, conn);
+        Reject(e.Value());
     }
 };
 
-struct PipelineWorker : Napi::AsyncWorker {
+struct PipelineWorker : CancellableWorker {
     std::shared_ptr<ConnectionPool> pool;
     std::vector<std::string> queries;
     std::vector<size_t> affected;
-    Napi::Promise::Deferred deferred;
     std::shared_ptr<pqxx::connection> conn;
 
     PipelineWorker(Napi::Env env, std::shared_ptr<ConnectionPool> p, std::vector<std::string> q, Napi::Promise::Deferred d)
-        : AsyncWorker(env), pool(p), queries(std::move(q)), deferred(d) {}
+        : CancellableWorker(env, d), pool(p), queries(std::move(q)) {}
 
     void Execute() override {
+        if (Cancelled()) {
+            SetError("Query cancelled");
+            return;
+        }
         conn = pool->acquire();
         if (!conn) {
             SetError("Failed to acquire connection from pool");
             return;
         }
+        if (control && !control->attach(conn)) {
+            SetError("Query cancelled");
+            return;
+        }
 
         try {
             pqxx::work txn(*conn);
             affected.reserve(queries.size());
+            // A cancel sent between statements hits an idle backend and is
+            // ignored, so check the flag ourselves before each step.
             for (const auto& sql : queries) {
+                if (Cancelled()) break;
                 affected.push_back(txn.exec(sql).affected_rows());
             }
-            txn.commit();
+            if (Cancelled()) {
+                txn.abort();
+                SetError("Query cancelled");
+            } else {
+                txn.commit();
+            }
         } catch (const std::exception& e) {
             SetError(e.what());
         }
+        if (control) reusable = control->detach();
     }
 
     void OnOK() override {
-        if (conn) pool->release(conn);
+        ReturnConnection(pool, conn);
+        if (settled) return;
         auto env = Env();
         auto results = Napi::Array::New(env, affected.size());
         for (size_t i = 0; i < affected.size(); ++i) {
             results[i] = Napi::Number::New(env, affected[i]);
         }
-        deferred.Resolve(results);
+        Resolve(results);
     }
 
     void OnError(const Napi::Error& e) override {
-        if (conn) pool->release(conn);
-        deferred.Reject(e.Value());
+        ReturnConnection(pool, conn);
+        Reject(e.Value());
     }
 };
 
@@ -189,6 +363,7 @@ struct PipelineWorker : Napi::AsyncWorker {
 
 Napi::Object Connection::Init(Napi::Env env, Napi::Object exports) {
     auto func = DefineClass(env, "Connection", {
+        StaticMethod("connect", &Connection::Connect),
         InstanceMethod("query", &Connection::Query),
         InstanceMethod("querySync", &Connection::QuerySync),
         InstanceMethod("prepare", &Connection::Prepare),
@@ -209,43 +384,215 @@ Napi::Object Connection::Init(Napi::Env env, Napi::Object exports) {
     return exports;
 }
 
-Connection::Connection(const Napi::CallbackInfo& info) : Napi::ObjectWrap<Connection>(info) {
-    auto env = info.Env();
+// --- Pool bootstrap ---
 
+inline bool ParseConnStr(const Napi::CallbackInfo& info, std::string& connStr) {
+    auto env = info.Env();
     if (info.Length() < 1 || !info[0].IsString()) {
         Napi::TypeError::New(env, "Connection string must be a string").ThrowAsJavaScriptException();
-        return;
+        return false;
     }
-
-    std::string connStr = info[0].As<Napi::String>().Utf8Value();
+    connStr = info[0].As<Napi::String>().Utf8Value();
     if (connStr.empty()) {
         Napi::Error::New(env, "Connection string cannot be empty").ThrowAsJavaScriptException();
+        return false;
+    }
+    return true;
+}
+
+inline bool ParseCount(Napi::Env env, Napi::Value value, const std::string& label, size_t& out) {
+    if (value.IsUndefined()) return true;
+    if (!value.IsNumber()) {
+        Napi::TypeError::New(env, label + " must be a number").ThrowAsJavaScriptException();
+        return false;
+    }
+    out = value.As<Napi::Number>().Uint32Value();
+    if (out == 0) {
+        Napi::RangeError::New(env, label + " must be at least 1").ThrowAsJavaScriptException();
+        return false;
+    }
+    return true;
+}
+
+inline bool ParseSharedPool(Napi::Env env, Napi::Object opts, std::string& key) {
+    auto shared = opts.Get("sharedPool");
+    if (shared.IsUndefined()) return true;
+    if (!shared.IsString() || shared.As<Napi::String>().Utf8Value().empty()) {
+        Napi::TypeError::New(env, "sharedPool must be a non-empty string").ThrowAsJavaScriptException();
+        return false;
+    }
+    key = shared.As<Napi::String>().Utf8Value();
+    return true;
+}
+
+// Creates a private pool or attaches to a shared one, starts opening every
+// connection in parallel and blocks until `minReady` of them are up.
+static std::shared_ptr<ConnectionPool> OpenPool(const std::string& connStr, size_t poolSize, size_t minReady, const std::string& sharedKey) {
+    auto pool = sharedKey.empty()
+        ? std::make_shared<ConnectionPool>(connStr, poolSize)
+        : PoolRegistry::attach(sharedKey, connStr, poolSize);
+    pool->warmUp(pool->maxSize());
+
+    if (!pool->waitReady(minReady)) {
+        if (sharedKey.empty()) pool->close();
+        else PoolRegistry::detach(sharedKey);
+        throw std::runtime_error(minReady == 1
+            ? "Failed to create initial database connection"
+            : "Failed to open " + std::to_string(minReady) + " initial database connections");
+    }
+    return pool;
+}
+
+// Passed to the constructor through a Napi::External by Connection.connect()
+struct PoolHandoff {
+    std::shared_ptr<ConnectionPool> pool;
+    std::string sharedKey;
+};
+
+struct ConnectWorker : Napi::AsyncWorker {
+    std::string connStr;
+    size_t poolSize;
+    size_t minIdle;
+    std::string sharedKey;
+    std::shared_ptr<ConnectionPool> pool;
+    Napi::Promise::Deferred deferred;
+
+    ConnectWorker(Napi::Env env, std::string cs, size_t size, size_t idle, std::string key, Napi::Promise::Deferred d)
+        : AsyncWorker(env), connStr(std::move(cs)), poolSize(size), minIdle(idle), sharedKey(std::move(key)), deferred(d) {}
+
+    // Only reached with a pool still held if the environment went away before OnOK
+    ~ConnectWorker() {
+        if (!pool) return;
+        if (sharedKey.empty()) pool->close();
+        else PoolRegistry::detach(sharedKey);
+    }
+
+    void Execute() override {
+        try {
+            pool = OpenPool(connStr, poolSize, minIdle, sharedKey);
+        } catch (const std::exception& e) {
+            SetError(std::string("Failed to create connection pool: ") + e.what());
+        }
+    }
+
+    void OnOK() override {
+        auto env = Env();
+        PoolHandoff handoff{std::move(pool), sharedKey};
+        auto* constructor = env.GetInstanceData<Napi::FunctionReference>();
+        deferred.Resolve(constructor->New({Napi::External<PoolHandoff>::New(env, &handoff)}));
+    }
+
+    void OnError(const Napi::Error& e) override {
+        deferred.Reject(e.Value());
+    }
+};
+
+Connection::Connection(const Napi::CallbackInfo& info) : Napi::ObjectWrap<Connection>(info) {
+    auto env = info.Env();
+
+    if (info.Length() == 1 && info[0].IsExternal()) {
+        auto* handoff = info[0].As<Napi::External<PoolHandoff>>().Data();
+        Adopt(env, std::move(handoff->pool), std::move(handoff->sharedKey));
         return;
     }
 
+    std::string connStr;
+    if (!ParseConnStr(info, connStr)) return;
+
     size_t poolSize = 10;
-    if (info.Length() > 1) {
-        if (!info[1].IsNumber()) {
-            Napi::TypeError::New(env, "Pool size must be a number").ThrowAsJavaScriptException();
-            return;
-        }
-        poolSize = info[1].As<Napi::Number>().Uint32Value();
-        if (poolSize == 0) {
-            Napi::RangeError::New(env, "Pool size must be at least 1").ThrowAsJavaScriptException();
+    if (info.Length() > 1 && !ParseCount(env, info[1], "Pool size", poolSize)) return;
+
+    std::string sharedKey;
+    if (info.Length() > 2 && !info[2].IsUndefined()) {
+        if (!info[2].IsObject()) {
+            Napi::TypeError::New(env, "Connection options must be an object").ThrowAsJavaScriptException();
             return;
         }
+        if (!ParseSharedPool(env, info[2].As<Napi::Object>(), sharedKey)) return;
     }
 
     try {
-        pool_ = std::make_shared<ConnectionPool>(connStr, poolSize);
+        Adopt(env, OpenPool(connStr, poolSize, 1, sharedKey), sharedKey);
     } catch (const std::exception& e) {
         Napi::Error::New(env, std::string("Failed to create connection pool: ") + e.what()).ThrowAsJavaScriptException();
     }
 }
 
+void Connection::Adopt(Napi::Env env, std::shared_ptr<ConnectionPool> pool, std::string sharedKey) {
+    pool_ = std::move(pool);
+    poolMax_ = pool_->maxSize();
+    sharedKey_ = std::move(sharedKey);
+    if (!sharedKey_.empty()) {
+        // Worker threads can exit without finalizing their objects; drop our
+        // reference on environment teardown so the shared pool can close.
+        env_ = env;
+        napi_add_env_cleanup_hook(env_, &Connection::EnvCleanup, this);
+    }
+}
+
+Napi::Value Connection::Connect(const Napi::CallbackInfo& info) {
+    auto env = info.Env();
+
+    std::string connStr;
+    if (!ParseConnStr(info, connStr)) return env.Undefined();
+
+    size_t poolSize = 10;
+    size_t minIdle = 1;
+    std::string sharedKey;
+    if (info.Length() > 1 && !info[1].IsUndefined()) {
+        if (!info[1].IsObject()) {
+            Napi::TypeError::New(env, "Connection options must be an object").ThrowAsJavaScriptException();
+            return env.Undefined();
+        }
+        auto opts = info[1].As<Napi::Object>();
+        if (!ParseCount(env, opts.Get("poolSize"), "Pool size", poolSize)) return env.Undefined();
+        if (!ParseCount(env, opts.Get("minIdle"), "minIdle", minIdle)) return env.Undefined();
+        if (!ParseSharedPool(env, opts, sharedKey)) return env.Undefined();
+    }
+    if (minIdle > poolSize) {
+        Napi::RangeError::New(env, "minIdle cannot exceed pool size").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+
+    auto deferred = Napi::Promise::Deferred::New(env);
+    auto* worker = new ConnectWorker(env, std::move(connStr), poolSize, minIdle, std::move(sharedKey), deferred);
+    worker->Queue();
+    return deferred.Promise();
+}
+
 Connection::~Connection() {
     for (auto& [_, listener] : listeners_) listener->stop();
-    if (pool_) pool_->close();
+    ReleasePool();
+}
+
+void Connection::EnvCleanup(void* arg) {
+    static_cast<Connection*>(arg)->ReleasePool();
+}
+
+// Private pools are closed outright; shared pools only lose this connection's
+// reference and are closed by the registry once nobody else holds them.
+void Connection::ReleasePool() {
+    if (!pool_) return;
+    if (sharedKey_.empty()) {
+        pool_->close();
+    } else {
+        napi_remove_env_cleanup_hook(env_, &Connection::EnvCleanup, this);
+        PoolRegistry::detach(sharedKey_);
+    }
+    pool_.reset();
+}
+
+bool Connection::CheckOpen(Napi::Env env) {
+    if (pool_) return true;
+    Napi::Error::New(env, "Connection is closed").ThrowAsJavaScriptException();
+    return false;
+}
+
+// Promise-returning methods report a closed connection through the promise
+inline Napi::Value ClosedPromise(Napi::Env env) {
+    auto deferred = Napi::Promise::Deferred::New(env);
+    deferred.Reject(Napi::Error::New(env, "Connection is closed").Value());
+    return deferred.Promise();
 }
 
 Napi::Value Connection::QuerySync(const Napi::CallbackInfo& info) {
@@ -255,6 +602,7 @@ Napi::Value Connection::QuerySync(const Napi::CallbackInfo& info) {
         Napi::TypeError::New(env, "SQL query must be a string").ThrowAsJavaScriptException();
         return env.Undefined();
     }
+    if (!CheckOpen(env)) return env.Undefined();
 
     try {
         auto conn = pool_->acquire();
@@ -287,11 +635,16 @@ Napi::Value Connection::Query(const Napi::CallbackInfo& info) {
         Napi::TypeError::New(env, "SQL query must be a string").ThrowAsJavaScriptException();
         return env.Undefined();
     }
+    if (!pool_) return ClosedPromise(env);
+
+    QueryOptions opts;
+    if (!ParseQueryOptions(info, 2, opts)) return env.Undefined();
 
     auto deferred = Napi::Promise::Deferred::New(env);
     auto cp = ConvertParams(info, 1);
 
     auto* worker = new QueryWorker(env, pool_, info[0].As<Napi::String>().Utf8Value(), std::move(cp), deferred);
+    worker->Arm(opts);
     worker->Queue();
     return deferred.Promise();
 }
@@ -322,11 +675,16 @@ Napi::Value Connection::Execute(const Napi::CallbackInfo& info) {
         Napi::Error::New(env, "Prepared statement not found: " + name).ThrowAsJavaScriptException();
         return env.Undefined();
     }
+    if (!pool_) return ClosedPromise(env);
+
+    QueryOptions opts;
+    if (!ParseQueryOptions(info, 2, opts)) return env.Undefined();
 
     auto deferred = Napi::Promise::Deferred::New(env);
     auto cp = ConvertParams(info, 1);
 
     auto* worker = new QueryWorker(env, pool_, it->second, std::move(cp), deferred);
+    worker->Arm(opts);
     worker->Queue();
     return deferred.Promise();
 }
@@ -338,6 +696,10 @@ Napi::Value Connection::Pipeline(const Napi::CallbackInfo& info) {
         Napi::TypeError::New(env, "pipeline() requires an array of SQL queries").ThrowAsJavaScriptException();
         return env.Undefined();
     }
+    if (!pool_) return ClosedPromise(env);
+
+    QueryOptions opts;
+    if (!ParseQueryOptions(info, 1, opts)) return env.Undefined();
 
     auto deferred = Napi::Promise::Deferred::New(env);
     auto queries = info[0].As<Napi::Array>();
@@ -350,12 +712,14 @@ Napi::Value Connection::Pipeline(const Napi::CallbackInfo& info) {
     }
 
     auto* worker = new PipelineWorker(env, pool_, std::move(queryList), deferred);
+    worker->Arm(opts);
     worker->Queue();
     return deferred.Promise();
 }
 
 Napi::Value Connection::Begin(const Napi::CallbackInfo& info) {
     auto env = info.Env();
+    if (!pool_) return ClosedPromise(env);
     auto deferred = Napi::Promise::Deferred::New(env);
     auto* worker = new QueryWorker(env, pool_, "BEGIN", ConvertedParams{}, deferred);
     worker->Queue();
@@ -364,6 +728,7 @@ Napi::Value Connection::Begin(const Napi::CallbackInfo& info) {
 
 Napi::Value Connection::Commit(const Napi::CallbackInfo& info) {
     auto env = info.Env();
+    if (!pool_) return ClosedPromise(env);
     auto deferred = Napi::Promise::Deferred::New(env);
     auto* worker = new QueryWorker(env, pool_, "COMMIT", ConvertedParams{}, deferred);
     worker->Queue();
@@ -372,6 +737,7 @@ Napi::Value Connection::Commit(const Napi::CallbackInfo& info) {
 
 Napi::Value Connection::Rollback(const Napi::CallbackInfo& info) {
     auto env = info.Env();
+    if (!pool_) return ClosedPromise(env);
     auto deferred = Napi::Promise::Deferred::New(env);
     auto* worker = new QueryWorker(env, pool_, "ROLLBACK", ConvertedParams{}, deferred);
     worker->Queue();
@@ -388,6 +754,7 @@ Napi::Value Connection::Listen(const Napi::CallbackInfo& info) {
 
     std::string channel = info[0].As<Napi::String>().Utf8Value();
     auto callback = info[1].As<Napi::Function>();
+    if (!CheckOpen(env)) return env.Undefined();
 
     auto conn = pool_->acquire();
     if (!conn) {
@@ -425,16 +792,16 @@ Napi::Value Connection::Unlisten(const Napi::CallbackInfo& info) {
 Napi::Value Connection::Close(const Napi::CallbackInfo& info) {
     for (auto& [_, listener] : listeners_) listener->stop();
     listeners_.clear();
-    if (pool_) pool_->close();
+    ReleasePool();
     return info.Env().Undefined();
 }
 
 Napi::Value Connection::PoolStatus(const Napi::CallbackInfo& info) {
     auto env = info.Env();
     Napi::Object stats = Napi::Object::New(env);
-    stats.Set("available", Napi::Number::New(env, pool_->availableCount()));
-    stats.Set("current", Napi::Number::New(env, pool_->currentCount()));
-    stats.Set("max", Napi::Number::New(env, pool_->maxSize()));
-    stats.Set("closed", Napi::Boolean::New(env, pool_->closed()));
+    stats.Set("available", Napi::Number::New(env, pool_ ? pool_->availableCount() : 0));
+    stats.Set("current", Napi::Number::New(env, pool_ ? pool_->currentCount() : 0));
+    stats.Set("max", Napi::Number::New(env, poolMax_));
+    stats.Set("closed", Napi::Boolean::New(env, !pool_ || pool_->closed()));
     return stats;
 }
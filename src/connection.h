@@ -2,6 +2,7 @@
 #include <napi.h>
 #include "connection_pool.h"
 #include "listener.h"
+#include "query_control.h"
 #include <memory>
 #include <unordered_map>
 
@@ -12,6 +13,7 @@ public:
     ~Connection();
 
 private:
+    static Napi::Value Connect(const Napi::CallbackInfo& info);
     Napi::Value Query(const Napi::CallbackInfo& info);
     Napi::Value QuerySync(const Napi::CallbackInfo& info);
     Napi::Value Prepare(const Napi::CallbackInfo& info);
@@ -25,7 +27,15 @@ private:
     Napi::Value Close(const Napi::CallbackInfo& info);
     Napi::Value PoolStatus(const Napi::CallbackInfo& info);
 
+    void Adopt(Napi::Env env, std::shared_ptr<ConnectionPool> pool, std::string sharedKey);
+    bool CheckOpen(Napi::Env env);
+    void ReleasePool();
+    static void EnvCleanup(void* arg);
+
     std::shared_ptr<ConnectionPool> pool_;
+    std::string sharedKey_;
+    napi_env env_ = nullptr;
+    size_t poolMax_ = 0;
     std::unordered_map<std::string, std::unique_ptr<Listener>> listeners_;
     std::unordered_map<std::string, std::string> prepared_;
 };
@@ -1,37 +1,69 @@
 #include "connection_pool.h"
-#include <thread>
+#include "tracked_threads.h"
+#include <algorithm>
+
+namespace {
+
+// Warm-up handshakes of every pool. They are owned here rather than by the
+// pool so close() never waits on one; any still running are joined during
+// static destruction at process exit.
+TrackedThreads& warmers() {
+    static TrackedThreads instance;
+    return instance;
+}
+
+}  // namespace
 
 ConnectionPool::ConnectionPool(const std::string& connStr, size_t poolSize)
-    : connStr_(connStr), poolSize_(poolSize), currentSize_(0) {
-    auto conn = createConnection();
-    if (!conn) {
-        throw std::runtime_error("Failed to create initial database connection");
+    : connStr_(connStr), poolSize_(poolSize), currentSize_(0) {}
+
+ConnectionPool::~ConnectionPool() {
+    close();
+}
+
+// Opens connections in parallel until `count` are open or in flight. Each
+// handshake reserves a slot up front so acquire() never overshoots poolSize_.
+// Handshakes only hold a weak reference, so a pool that is closed and released
+// meanwhile is freed right away and the late connection is dropped.
+void ConnectionPool::warmUp(size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) return;
+
+    count = std::min(count, poolSize_);
+    for (; currentSize_ < count; ++currentSize_) {
+        ++pending_;
+        warmers().spawn([pool = weak_from_this(), connStr = connStr_]() {
+            auto conn = createConnection(connStr);
+            if (auto self = pool.lock()) self->finishWarmUp(std::move(conn));
+        });
     }
-    available_.push_back({conn, std::chrono::steady_clock::now()});
-    currentSize_ = 1;
-
-    if (poolSize > 1) {
-        std::thread([this, poolSize]() {
-            for (size_t i = 1; i < poolSize; ++i) {
-                try {
-                    auto c = std::make_shared<pqxx::connection>(connStr_);
-                    if (c && c->is_open()) {
-                        std::lock_guard<std::mutex> lock(mutex_);
-                        if (!closed_) {
-                            available_.push_back({c, std::chrono::steady_clock::now()});
-                            currentSize_++;
-                        }
-                    }
-                } catch (const std::exception&) {
-                    continue;
-                }
-            }
-        }).detach();
+}
+
+void ConnectionPool::finishWarmUp(std::shared_ptr<pqxx::connection> conn) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --pending_;
+    // close() has already reset currentSize_, so there is no slot to give back
+    if (!closed_) {
+        if (conn) {
+            available_.push_back({conn, std::chrono::steady_clock::now()});
+        } else {
+            --currentSize_;
+        }
     }
+    ready_.notify_all();
 }
 
-ConnectionPool::~ConnectionPool() {
-    close();
+// Blocks until `count` connections are established. Returns false once the
+// pool is closed or every in-flight handshake has finished short of `count`.
+bool ConnectionPool::waitReady(size_t count) {
+    count = std::min(count, poolSize_);
+    warmUp(count);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    ready_.wait(lock, [&] {
+        return closed_ || pending_ == 0 || currentSize_ - pending_ >= count;
+    });
+    return !closed_ && currentSize_ - pending_ >= count;
 }
 
 bool ConnectionPool::isHealthy(const PooledConnection& pooled) {
@@ -54,46 +86,64 @@ bool ConnectionPool::isHealthy(const PooledConnection& pooled) {
     }
 }
 
-std::shared_ptr<pqxx::connection> ConnectionPool::createConnection() {
+std::shared_ptr<pqxx::connection> ConnectionPool::createConnection(const std::string& connStr) {
     try {
-        auto conn = std::make_shared<pqxx::connection>(connStr_);
+        auto conn = std::make_shared<pqxx::connection>(connStr);
         if (conn->is_open()) return conn;
     } catch (const std::exception&) {}
     return nullptr;
 }
 
 std::shared_ptr<pqxx::connection> ConnectionPool::acquire() {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
 
-    while (!available_.empty()) {
-        auto pooled = available_.back();
-        available_.pop_back();
+    while (true) {
+        while (!available_.empty()) {
+            auto pooled = available_.back();
+            available_.pop_back();
 
-        auto idleSeconds = std::chrono::duration_cast<std::chrono::seconds>(
-            std::chrono::steady_clock::now() - pooled.lastUsed
-        ).count();
+            auto idleSeconds = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::steady_clock::now() - pooled.lastUsed
+            ).count();
 
-        if (idleSeconds > MAX_IDLE_SECONDS) {
-            currentSize_--;
-            continue;
-        }
+            if (idleSeconds > MAX_IDLE_SECONDS) {
+                currentSize_--;
+                continue;
+            }
 
-        if (!isHealthy(pooled)) {
-            currentSize_--;
-            continue;
+            // The connection is off the idle list and its slot still counted, so
+            // the round trip can run without blocking the rest of the pool.
+            lock.unlock();
+            bool healthy = isHealthy(pooled);
+            lock.lock();
+
+            if (!healthy) {
+                // close() resets currentSize_, leaving no slot to give back
+                if (!closed_) currentSize_--;
+                continue;
+            }
+
+            return pooled.conn;
         }
 
-        return pooled.conn;
-    }
+        if (currentSize_ < poolSize_ && !closed_) {
+            // Reserve the slot first, then handshake without holding the lock
+            currentSize_++;
+            lock.unlock();
+            auto conn = createConnection(connStr_);
+            lock.lock();
 
-    if (currentSize_ < poolSize_ && !closed_) {
-        currentSize_++;
-        auto conn = createConnection();
-        if (conn) return conn;
-        currentSize_--;
-    }
+            if (conn) return conn;
+            if (!closed_) currentSize_--;
+        }
 
-    return nullptr;
+        // Slots held by in-flight warm-up handshakes will turn into connections
+        // shortly; wait for one instead of failing while the pool is starting.
+        if (closed_ || pending_ == 0) return nullptr;
+        ready_.wait(lock, [this] {
+            return closed_ || pending_ == 0 || !available_.empty();
+        });
+    }
 }
 
 void ConnectionPool::release(std::shared_ptr<pqxx::connection> conn) {
@@ -102,14 +152,24 @@ void ConnectionPool::release(std::shared_ptr<pqxx::connection> conn) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (!closed_) {
         available_.push_back({conn, std::chrono::steady_clock::now()});
+        ready_.notify_all();
     }
 }
 
+// Gives up the slot of a connection that must not be reused
+void ConnectionPool::discard(std::shared_ptr<pqxx::connection> conn) {
+    if (!conn) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!closed_ && currentSize_ > 0) currentSize_--;
+}
+
 void ConnectionPool::close() {
     std::lock_guard<std::mutex> lock(mutex_);
     closed_ = true;
     available_.clear();
     currentSize_ = 0;
+    ready_.notify_all();
 }
 
 size_t ConnectionPool::availableCount() {
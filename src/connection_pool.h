@@ -5,18 +5,22 @@
 #include <memory>
 #include <string>
 #include <chrono>
+#include <condition_variable>
 
 struct PooledConnection {
     std::shared_ptr<pqxx::connection> conn;
     std::chrono::steady_clock::time_point lastUsed;
 };
 
-class ConnectionPool {
+class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 public:
     ConnectionPool(const std::string& connStr, size_t poolSize);
     ~ConnectionPool();
+    void warmUp(size_t count);
+    bool waitReady(size_t count);
     std::shared_ptr<pqxx::connection> acquire();
     void release(std::shared_ptr<pqxx::connection> conn);
+    void discard(std::shared_ptr<pqxx::connection> conn);
     void close();
 
     size_t availableCount();
@@ -26,13 +30,16 @@ public:
 
 private:
     bool isHealthy(const PooledConnection& pooled);
-    std::shared_ptr<pqxx::connection> createConnection();
+    static std::shared_ptr<pqxx::connection> createConnection(const std::string& connStr);
+    void finishWarmUp(std::shared_ptr<pqxx::connection> conn);
 
     std::string connStr_;
     size_t poolSize_;
     size_t currentSize_;
+    size_t pending_ = 0;
     std::vector<PooledConnection> available_;
     std::mutex mutex_;
+    std::condition_variable ready_;
     bool closed_ = false;
     static constexpr int MAX_IDLE_SECONDS = 300;
     static constexpr int HEALTH_CHECK_IDLE_SECONDS = 30;
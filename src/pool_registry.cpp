@@ -0,0 +1,43 @@
+#include "pool_registry.h"
+
+std::mutex PoolRegistry::mutex_;
+std::unordered_map<std::string, PoolRegistry::Entry> PoolRegistry::pools_;
+
+std::shared_ptr<ConnectionPool> PoolRegistry::attachExisting(const std::string& key, const std::string& connStr) {
+    auto it = pools_.find(key);
+    if (it == pools_.end()) return nullptr;
+    if (it->second.connStr != connStr) {
+        throw std::runtime_error("Shared pool '" + key + "' already exists with a different connection string");
+    }
+    it->second.refs++;
+    return it->second.pool;
+}
+
+std::shared_ptr<ConnectionPool> PoolRegistry::attach(const std::string& key, const std::string& connStr, size_t poolSize) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto pool = attachExisting(key, connStr)) return pool;
+    }
+
+    // Build outside the lock so other isolates never wait on this pool's setup.
+    // If another attach registered the key meanwhile, use theirs and drop ours.
+    auto pool = std::make_shared<ConnectionPool>(connStr, poolSize);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto existing = attachExisting(key, connStr)) return existing;
+    pools_.emplace(key, Entry{pool, connStr, 1});
+    return pool;
+}
+
+void PoolRegistry::detach(const std::string& key) {
+    std::shared_ptr<ConnectionPool> last;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pools_.find(key);
+        if (it == pools_.end()) return;
+        if (--it->second.refs > 0) return;
+        last = std::move(it->second.pool);
+        pools_.erase(it);
+    }
+    last->close();
+}
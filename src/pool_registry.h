@@ -0,0 +1,27 @@
+#pragma once
+#include "connection_pool.h"
+#include <unordered_map>
+#include <mutex>
+#include <memory>
+#include <string>
+
+// Process-wide table of named pools. Connections in any isolate (main thread
+// or worker_threads) that attach with the same key share one ConnectionPool;
+// the pool is closed when the last reference is detached.
+class PoolRegistry {
+public:
+    static std::shared_ptr<ConnectionPool> attach(const std::string& key, const std::string& connStr, size_t poolSize);
+    static void detach(const std::string& key);
+
+private:
+    struct Entry {
+        std::shared_ptr<ConnectionPool> pool;
+        std::string connStr;
+        size_t refs;
+    };
+
+    static std::shared_ptr<ConnectionPool> attachExisting(const std::string& key, const std::string& connStr);
+
+    static std::mutex mutex_;
+    static std::unordered_map<std::string, Entry> pools_;
+};
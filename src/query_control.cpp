@@ -0,0 +1,141 @@
+#include "query_control.h"
+#include "tracked_threads.h"
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <condition_variable>
+
+namespace {
+
+// Schedules cancel requests for the whole process. Each PQcancel is a blocking
+// connect with no timeout, so every send runs on its own tracked thread and an
+// unreachable server cannot hold up the others. All threads are joined during
+// static destruction at process exit.
+//
+// A cancel that reaches the backend before the statement does is ignored, so
+// requests are re-sent with exponential backoff for as long as the worker
+// keeps its connection attached.
+class Canceller {
+public:
+    ~Canceller() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            queue_.clear();
+        }
+        wake_.notify_all();
+        if (scheduler_.joinable()) scheduler_.join();
+        // senders_ is destroyed next and joins any send still in progress
+    }
+
+    void submit(std::shared_ptr<QueryControl> control) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) return;
+        if (!scheduler_.joinable()) scheduler_ = std::thread(&Canceller::run, this);
+        queue_.push_back({std::move(control), std::chrono::steady_clock::now(), FIRST_RESEND});
+        wake_.notify_one();
+    }
+
+private:
+    struct Pending {
+        std::shared_ptr<QueryControl> control;
+        std::chrono::steady_clock::time_point due;
+        std::chrono::milliseconds backoff;
+    };
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) return;
+
+            auto next = std::min_element(queue_.begin(), queue_.end(),
+                [](const Pending& a, const Pending& b) { return a.due < b.due; });
+            if (next->due > std::chrono::steady_clock::now()) {
+                wake_.wait_until(lock, next->due);
+                continue;
+            }
+
+            Pending pending = std::move(*next);
+            queue_.erase(next);
+            senders_.spawn([this, pending = std::move(pending)]() { send(pending); });
+        }
+    }
+
+    // The next resend is only scheduled once this one has finished, so a
+    // query never has more than one cancel request open at a time.
+    void send(const Pending& pending) {
+        bool inFlight = pending.control->sendCancel();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!inFlight || stopping_) return;
+        queue_.push_back({pending.control,
+                          std::chrono::steady_clock::now() + pending.backoff,
+                          std::min(pending.backoff * 2, MAX_RESEND)});
+        wake_.notify_one();
+    }
+
+    static constexpr std::chrono::milliseconds FIRST_RESEND{100};
+    static constexpr std::chrono::milliseconds MAX_RESEND{5000};
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<Pending> queue_;
+    std::thread scheduler_;
+    bool stopping_ = false;
+    TrackedThreads senders_;
+};
+
+Canceller& canceller() {
+    static Canceller instance;
+    return instance;
+}
+
+}  // namespace
+
+bool QueryControl::attach(std::shared_ptr<pqxx::connection> conn) {
+    // Checked under the lock so a cancel either sees the connection or stops the query here
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cancelled_) return false;
+    conn_ = std::move(conn);
+    return true;
+}
+
+// Returns false if a cancel request was still being sent. The caller must then
+// drop the connection: the request may yet land on whatever it runs next.
+bool QueryControl::detach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    conn_.reset();
+    return sending_ == 0;
+}
+
+void QueryControl::cancel() {
+    if (cancelled_.exchange(true)) return;
+    // PQcancel opens a fresh connection to the server; keep that off the JS thread.
+    canceller().submit(shared_from_this());
+}
+
+// Returns true while the connection is still attached, i.e. the query may not
+// have seen the cancel yet. The lock is not held across the network round trip.
+bool QueryControl::sendCancel() {
+    std::shared_ptr<pqxx::connection> conn;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!conn_) return false;
+        conn = conn_;
+        ++sending_;
+    }
+
+    try {
+        conn->cancel_query();
+    } catch (const std::exception&) {}
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    --sending_;
+    return conn_ != nullptr;
+}
+
+bool QueryControl::cancelled() const {
+    return cancelled_;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <pqxx/pqxx>
+#include <mutex>
+#include <memory>
+#include <atomic>
+
+// Cancellation handle shared between an async worker and the JS thread.
+// The worker attaches its pooled connection while a statement is in flight;
+// cancel() queues a protocol-level cancel request for it on the canceller.
+class QueryControl : public std::enable_shared_from_this<QueryControl> {
+public:
+    bool attach(std::shared_ptr<pqxx::connection> conn);
+    bool detach();
+    void cancel();
+    bool sendCancel();
+    bool cancelled() const;
+
+private:
+    std::mutex mutex_;
+    std::shared_ptr<pqxx::connection> conn_;
+    size_t sending_ = 0;
+    std::atomic<bool> cancelled_{false};
+};
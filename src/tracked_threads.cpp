@@ -0,0 +1,30 @@
+#include "tracked_threads.h"
+
+TrackedThreads::~TrackedThreads() {
+    std::list<Entry> threads;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        threads.swap(threads_);
+    }
+    for (auto& entry : threads) entry.thread.join();
+}
+
+void TrackedThreads::spawn(std::function<void()> fn) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // A thread flagged done has nothing left to run, so joining it is immediate
+    for (auto it = threads_.begin(); it != threads_.end();) {
+        if (*it->done) {
+            it->thread.join();
+            it = threads_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto done = std::make_shared<std::atomic<bool>>(false);
+    threads_.push_back({std::thread([fn = std::move(fn), done]() {
+        fn();
+        *done = true;
+    }), done});
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <list>
+#include <memory>
+#include <atomic>
+#include <functional>
+
+// Owns background threads that must never be detached. Finished threads are
+// joined on the next spawn(); any still running are joined by the destructor.
+class TrackedThreads {
+public:
+    ~TrackedThreads();
+    void spawn(std::function<void()> fn);
+
+private:
+    struct Entry {
+        std::thread thread;
+        std::shared_ptr<std::atomic<bool>> done;
+    };
+
+    std::mutex mutex_;
+    std::list<Entry> threads_;
+};